@@ -130,4 +130,64 @@ oes_api_event_recv(
                   void * event_recv_vs_ext
                   );
 
+/**
+* This function sets port flap damping for port up/down events.
+* Every up/down transition of the port adds flap_penalty to the
+* port penalty, which decays by half every half_life_sec. When
+* the penalty exceeds suppress_threshold the port events
+* (OES_EVENT_ID_PORT) are suppressed and a single
+* OES_EVENT_ID_PORT_DAMPING event is sent. When the penalty
+* decays below reuse_threshold, or after max_suppress_sec, a
+* OES_EVENT_ID_PORT_DAMPING event with the number of suppressed
+* transitions and the current state is sent and port events are
+* reported again.
+* Damping only filters the events delivered to the registered
+* file descriptors. The library itself, e.g. the port state cache
+* of oes_api_port_state_get, still sees every transition.
+*
+* @param[in] br_id - Bridge id 
+* @param[in] log_port - logical port.
+* @param[in] damping_params - damping parameters.
+* @param[in,out] event_port_damping_vs_ext - vendor specific
+*       extention
+* 
+* @return OES_STATUS_SUCCESS if operation completes successfully
+* @return OES_STATUS_PARAM_ERROR if any input parameters is 
+*         invalid
+* @return OES_STATUS_ERROR general error 
+*/
+oes_status_e
+oes_api_event_port_damping_set(
+                              int  br_id,
+                              unsigned int  log_port,
+                              struct oes_event_port_damping_params * damping_params,
+                              void * event_port_damping_vs_ext
+                              );
+
+
+/**
+* This function gets port flap damping parameters and state.
+*
+* @param[in] br_id - Bridge id 
+* @param[in] log_port - logical port.
+* @param[out] damping_params - damping parameters.
+* @param[out] damping_state - current penalty and suppression
+*       state.
+* @param[in,out] event_port_damping_vs_ext - vendor specific
+*       extention
+* 
+* @return OES_STATUS_SUCCESS if operation completes successfully
+* @return OES_STATUS_PARAM_ERROR if any input parameters is 
+*         invalid
+* @return OES_STATUS_ERROR general error 
+*/
+oes_status_e
+oes_api_event_port_damping_get(
+                              int  br_id,
+                              unsigned int  log_port,
+                              struct oes_event_port_damping_params * damping_params,
+                              struct oes_event_port_damping * damping_state,
+                              void * event_port_damping_vs_ext
+                              );
+
 #endif /* __OES_API_EVENT_H__ */
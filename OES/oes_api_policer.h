@@ -0,0 +1,150 @@
+/* This software is available to you under a choice of one of two
+* licenses.  You may choose to be licensed under the terms of the GNU
+* General Public License (GPL) Version 2, available from the file
+* COPYING, or the Open Ethernet BSD license below:
+*
+*     Redistribution and use in source and binary forms, with or
+*     without modification, are permitted provided that the following
+*     conditions are met:
+*
+*      - Redistributions of source code must retain the above
+*        copyright notice, this list of conditions and the following
+*        disclaimer.
+*
+*      - Redistributions in binary form must reproduce the above
+*        copyright notice, this list of conditions and the following
+*        disclaimer in the documentation and/or other materials
+*        provided with the distribution.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+* BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+* ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE. 
+*/
+
+#ifndef __OES_API_POLICER_H__
+#define __OES_API_POLICER_H__
+
+#include <oes_types.h>
+
+/************************************************
+ *  API functions
+ ***********************************************/
+
+
+/**
+ * This function sets the log verbosity level of policer MODULE
+ * @param[in]  verbosity_level  - policer module verbosity level
+ *
+ * @return OES_STATUS_SUCCESS - Operation completes successfully
+ * @return OES_STATUS_PARAM_ERROR - Unsupported verbosity_level
+ * @return OES_STATUS_ERROR general error. 
+ */
+oes_status_e
+oes_api_policer_log_verbosity_level_set(
+                                       int   verbosity_level
+                                       );
+
+/**
+ * This function gets the log verbosity level of policer MODULE
+ * @param[out]  verbosity_level_p  - policer module verbosity 
+ *       level
+ *
+ * @return OES_STATUS_SUCCESS - Operation completes successfully
+ * @return OES_STATUS_PARAM_ERROR - Unsupported verbosity_level
+ * @return OES_STATUS_ERROR general error. 
+ */
+oes_status_e
+oes_api_policer_log_verbosity_level_get(
+                                       int   * verbosity_level_p
+                                       );
+
+
+/**
+ *  This function creates/edits/destroys a policer. The policer
+ *  ID is allocated and returned to the caller when cmd is
+ *  CREATE, otherwise it is given by the caller. A policer can
+ *  be bound to ports with oes_api_port_policer_bind_set, it
+ *  must be unbound from all ports before it is destroyed.
+ *
+ * @param[in] br_id - Bridge id  
+ * @param[in] access_cmd - CREATE / EDIT / DESTROY 
+ * @param[in,out] policer_id - Policer ID 
+ * @param[in] policer_params - policer parameters, ignored when 
+ *       cmd is DESTROY.
+ * @param[in,out] policer_vs_ext - vendor specific extention
+ * @return OES_STATUS_SUCCESS - Operation completes successfully
+ * @return OES_STATUS_PARAM_ERROR - Input parameters error. 
+ * @return OES_STATUS_NO_RESOURCES if no policer is available 
+ *         to create
+ * @return OES_STATUS_ERROR general error.  
+ */
+oes_status_e 
+oes_api_policer_set(
+                   int br_id,
+                   enum oes_access_cmd access_cmd,
+                   unsigned int * policer_id,
+                   struct oes_policer_params * policer_params,
+                   void * policer_vs_ext
+                   );
+
+
+/**
+ *  This function gets the parameters of a policer.
+ *
+ * @param[in] br_id - Bridge id  
+ * @param[in] policer_id - Policer ID 
+ * @param[out] policer_params - policer parameters.
+ * @param[in,out] policer_vs_ext - vendor specific extention
+ * @return OES_STATUS_SUCCESS - Operation completes successfully
+ * @return OES_STATUS_PARAM_ERROR - Input parameters error. 
+ * @return OES_STATUS_ENTRY_NOT_FOUND if policer was not created.
+ * @return OES_STATUS_ERROR general error.  
+ */
+oes_status_e 
+oes_api_policer_get(
+                   int br_id,
+                   unsigned int policer_id,
+                   struct oes_policer_params * policer_params,
+                   void * policer_vs_ext
+                   );
+
+
+/**
+ *  This function meters a list of packets with the software
+ *  token buckets of a policer and returns the color of each
+ *  packet. The buckets are refilled from the CPU time stamp
+ *  counter and updated with atomic operations, the function
+ *  takes no lock and may be called from several threads on the
+ *  same policer. It is used to rate limit the trap path and to
+ *  simulate the device policer.
+ *
+ * @param[in] br_id - Bridge id  
+ * @param[in] policer_id - Policer ID 
+ * @param[in] packet_len_list - length of each packet in bytes 
+ * @param[in,out] color_list - In: packet color, used when the 
+ *       policer is color aware Out: packet color 
+ * @param[in] packet_cnt - arrays size 
+ * @param[in,out] policer_meter_vs_ext - vendor specific 
+ *       extention
+ * @return OES_STATUS_SUCCESS - Operation completes successfully
+ * @return OES_STATUS_PARAM_ERROR - Input parameters error. 
+ * @return OES_STATUS_ENTRY_NOT_FOUND if policer was not created.
+ * @return OES_STATUS_ERROR general error.  
+ */
+oes_status_e 
+oes_api_policer_meter(
+                     int br_id,
+                     unsigned int policer_id,
+                     unsigned short * packet_len_list,
+                     enum oes_policer_color * color_list,
+                     unsigned int packet_cnt,
+                     void * policer_meter_vs_ext
+                     );
+
+
+#endif /* __OES_API_POLICER_H__ */
@@ -106,6 +106,47 @@ oes_api_port_mtu_get(
 
 
 
+/**
+ *  This function Sets several attributes of a list of ports in
+ *  a single call. For each port only the attributes in
+ *  field_mask are set, each attribute is set as by its single
+ *  port function (oes_api_port_mtu_set, oes_api_port_state_set,
+ *  oes_api_port_speed_capability_set, oes_api_port_flow_ctrl_set,
+ *  oes_api_vlan_port_pvid_set). All entries are validated
+ *  first, if any entry is invalid nothing is applied. The
+ *  entries are then applied in one pass, grouping the device
+ *  writes of the same attribute. A device error while applying
+ *  is not rolled back: the failing entry is reported in
+ *  status_list, the attributes of it written before the error
+ *  remain set, and the other entries are still applied. Entries
+ *  with status OES_STATUS_SUCCESS are fully applied.
+ *
+ * @param[in] br_id - Bridge id 
+ * @param[in] cfg_list - per port attributes array 
+ * @param[in] cfg_cnt - array size 
+ * @param[out] status_list - status of each entry, array of 
+ *       cfg_cnt elements
+ * @param[in,out] port_cfg_bulk_vs_ext - vendor specific 
+ *       extention 
+ *  
+ * @return OES_STATUS_SUCCESS - Operation completes successfully
+ * @return OES_STATUS_PARAM_ERROR - at least one entry is 
+ *         invalid, see status_list. Nothing was applied.
+ * @return OES_STATUS_ERROR at least one entry failed while 
+ *         applied, see status_list. The other entries were 
+ *         applied. 
+ */
+oes_status_e
+oes_api_port_cfg_bulk_set(
+                         int br_id,
+                         struct oes_port_cfg * cfg_list,
+                         unsigned short cfg_cnt,
+                         oes_status_e * status_list,
+                         void * port_cfg_bulk_vs_ext
+                         );
+
+
+
 /**
  *  This function Sets the Port Type & Speed.It enables the 
  *  application to set the port enabled mode(s). When link is
@@ -285,6 +326,9 @@ oes_api_port_state_set(
 /**
  *  This function Retrieves the Port's Administrative,
  *  Operationa State 
+ *  The state is returned from a cache kept up to date by
+ *  oes_api_port_state_set and by the port up/down events
+ *  (OES_EVENT_ID_PORT), the device is not accessed.
  *  
  * @param[in] br_id - Bridge id
  * @param[in] log_port - Logical port ID.
@@ -305,6 +349,35 @@ oes_api_port_state_get(
                       void * port_state_vs_ext
                       );
 
+/**
+ *  This function Retrieves the Administrative and Operational
+ *  State of all the ports from the port state cache as bitmaps.
+ *  Bit n of word n / 64 refers to logical port n.
+ *  
+ * @param[in] br_id - Bridge id
+ * @param[out] admin_enable_bitmap - bit set if port admin 
+ *       state is enabled.
+ * @param[out] oper_up_bitmap - bit set if port oper state is 
+ *       up.
+ * @param[in] bitmap_len - number of 64 bit words of each 
+ *       bitmap. 
+ * @param[in,out] port_state_vs_ext - vendor specific extention
+ *  
+ * @return EOS_STATUS_SUCCESS if operation completes successfully
+ * @return EOS_STATUS_PARAM_ERROR: Input parameters error. 
+ * @return EOS_STATUS_PARAM_EXCEEDS_RANGE if the bitmaps can not 
+ *         hold the highest logical port.
+ * @return OES_STATUS_ERROR general error.  
+ */
+oes_status_e
+oes_api_port_state_bulk_get(
+                           int br_id,
+                           unsigned long long * admin_enable_bitmap,
+                           unsigned long long * oper_up_bitmap,
+                           unsigned int bitmap_len,
+                           void * port_state_vs_ext
+                           );
+
 /**
  *  This function Sets the Port Flow Control Pause
  *     Configuration
@@ -360,8 +433,86 @@ oes_api_port_flow_ctrl_get(
                           void * port_flow_ctrl_vs_ext
                           );
 
+/**
+ * This function Creates / Destroys a port counters consumer. 
+ * The library keeps a 64 bit software accumulator for every 
+ * port counter, the device counters are read and cleared by 
+ * the library only, often enough to never overflow. Each 
+ * consumer has its own clear baseline: a READ CLEAR by a 
+ * consumer returns the counters since its own last clear and 
+ * moves its baseline only, the counters seen by the other 
+ * consumers are not affected. 
+ * Consumer 0 always exists and is the consumer of the single 
+ * group getters (oes_api_port_cntr_ieee_802_dot_3_get, ...), 
+ * every poller which clears counters independently of the 
+ * others must create its own consumer and read through 
+ * oes_api_port_cntr_consumer_get or oes_api_port_cntr_bulk_get. 
+ *
+ * @param[in] br_id - Bridge id 
+ * @param[in] cmd - access cmd (CREATE/DESTROY) 
+ * @param[in,out] consumer_id - consumer ID, allocated and 
+ *       returned when cmd is CREATE.
+ * @param[in,out] port_cntr_consumer_vs_ext - vendor specific 
+ *       extention
+ * @return EOS_STATUS_SUCCESS if operation completes successfully
+ * @return EOS_STATUS_PARAM_ERROR: Input parameters error. 
+ * @return EOS_STATUS_NO_RESOURCES if no consumer is available 
+ *         to create.
+ * @return OES_STATUS_ERROR general error. 
+ */
+oes_status_e
+oes_api_port_cntr_consumer_set(
+                              int br_id,
+                              enum oes_access_cmd cmd,
+                              unsigned int * consumer_id,
+                              void * port_cntr_consumer_vs_ext
+                              );
+
+/**
+ * This function Retrieves counter groups of a port as seen by 
+ * a consumer. READ CLEAR returns the counters since the last 
+ * clear of consumer_id and moves its baseline only. 
+ *
+ * @param[in] br_id - Bridge id 
+ * @param[in] access_cmd -  READ/READ CLEAR  
+ * @param[in] consumer_id - consumer ID, 0 for the default 
+ *       consumer.
+ * @param[in] log_port - Logical Port ID.
+ * @param[out] cntr_ieee_802_dot_3_p - IEEE 802.3 counters 
+ *       entry, may be NULL.
+ * @param[out] cntr_rfc_2863_p - RFC 2863 counters entry, may be 
+ *       NULL.
+ * @param[out] cntr_rfc_2819_p - RFC 2819 counters entry, may be 
+ *       NULL.
+ * @param[out] cntr_rfc_3635_p - RFC 3635 counters entry, may be 
+ *       NULL.
+ * @param[in,out] port_cntr_consumer_vs_ext - vendor specific 
+ *       extention
+ * @return EOS_STATUS_SUCCESS if operation completes successfully
+ * @return EOS_STATUS_PARAM_ERROR: Input parameters error. 
+ * @return EOS_STATUS_ENTRY_NOT_FOUND if the consumer was not 
+ *         created.
+ * @return OES_STATUS_ERROR general error. 
+ */
+oes_status_e
+oes_api_port_cntr_consumer_get(
+                              int br_id,
+                              enum oes_access_cmd access_cmd,
+                              unsigned int consumer_id,
+                              unsigned long log_port,
+                              struct oes_port_cntr_ieee_802_dot_3 * cntr_ieee_802_dot_3_p,
+                              struct oes_port_cntr_rfc_2863 * cntr_rfc_2863_p,
+                              struct oes_port_cntr_rfc_2819 * cntr_rfc_2819_p,
+                              struct oes_port_cntr_rfc_3635 * cntr_rfc_3635_p,
+                              void * port_cntr_consumer_vs_ext
+                              );
+
 /**
  * This function Retrieves the Port IEEE 802.3 Counters 
+ * READ CLEAR clears the counters of the default consumer 0, 
+ * shared by all the callers of this function. Independent 
+ * pollers must use oes_api_port_cntr_consumer_get with their 
+ * own consumer. 
  *
  * @param[in] br_id - Bridge id 
  * @param[in] access_cmd -  READ/READ CLEAR  
@@ -385,6 +536,10 @@ oes_api_port_cntr_ieee_802_dot_3_get(
 
 /**
  * This function Retrieves the Port RFC 2863 Counters 
+ * READ CLEAR clears the counters of the default consumer 0, 
+ * shared by all the callers of this function. Independent 
+ * pollers must use oes_api_port_cntr_consumer_get with their 
+ * own consumer. 
  *
  * @param[in] br_id - Bridge id 
  * @param[in] access_cmd -  READ/READ CLEAR   
@@ -407,7 +562,10 @@ oes_api_port_cntr_rfc_2863_get(
 
 /**
  *  This function Retrieves the Port RFC 2819 Counters from the
- *  SDK.
+ *  SDK. READ CLEAR clears the counters of the default consumer
+ *  0, shared by all the callers of this function. Independent
+ *  pollers must use oes_api_port_cntr_consumer_get with their
+ *  own consumer.
  *  
  * @param[in] br_id - Bridge id 
  * @param[in] enum oes_access_cmd access_cmd, 
@@ -431,7 +589,10 @@ oes_api_port_cntr_rfc_2819_get(
 
 /**
  *  This function Retrieves the Port RFC 3635 Counters from the
- *  SDK.
+ *  SDK. READ CLEAR clears the counters of the default consumer
+ *  0, shared by all the callers of this function. Independent
+ *  pollers must use oes_api_port_cntr_consumer_get with their
+ *  own consumer.
  *
  * @param[in] br_id - Bridge id 
  * @param[in] enum oes_access_cmd access_cmd,  
@@ -454,11 +615,119 @@ oes_api_port_cntr_rfc_3635_get(
 		                      );
 
 
+/**
+ * This function Retrieves several counter groups of a list of 
+ * ports in a single call. Every requested group is written to 
+ * its own caller allocated array of the group counters 
+ * structure (an array of structures per group), element i of 
+ * each array holds the counters of log_port_list[i]. The group 
+ * structures are the ones of the single port getters, so the 
+ * same code can process the counters of both. The device is read once per port for all 
+ * requested groups. READ CLEAR clears the counters of 
+ * cntr_bulk->consumer_id only. 
+ *
+ * @param[in] br_id - Bridge id 
+ * @param[in] access_cmd -  READ/READ CLEAR   
+ * @param[in,out] cntr_bulk - In: counter groups, port list and 
+ *       counter arrays Out: counters, snapshot timestamp and 
+ *       collection time.
+ * @param[in,out] port_cntr_bulk_vs_ext - vendor specific 
+ *       extention
+ *  
+ * @return EOS_STATUS_SUCCESS if operation completes successfully
+ * @return EOS_STATUS_PARAM_ERROR: Input parameters error. 
+ * @return OES_STATUS_ERROR general error. 
+ */
+oes_status_e
+oes_api_port_cntr_bulk_get(
+                          int br_id,
+                          enum oes_access_cmd access_cmd,
+                          struct oes_port_cntr_bulk * cntr_bulk,
+                          void * port_cntr_bulk_vs_ext
+                          );
+
+/**
+ * This function controls the counter history of the bridge 
+ * ports. Using access cmd CREATE the library starts reading the 
+ * requested counter groups of every port each interval_msec and 
+ * keeps the last depth snapshots per port in a ring. The ring 
+ * has a single writer and is read without locks, any number of 
+ * consumers may read rates with oes_api_port_cntr_rate_get 
+ * without issuing device reads. Use EDIT to change the 
+ * parameters and DESTROY to stop the history. 
+ * Deltas are computed modulo 2^64 so wrapped counters yield the 
+ * correct delta. The history is kept on the software 
+ * accumulators, a READ CLEAR issued through the counter getters 
+ * does not affect it. 
+ *  
+ * @param[in] br_id - Bridge id 
+ * @param[in] cmd - access cmd (CREATE/DESTROY/EDIT) 
+ * @param[in] history_params - counter groups, depth, interval 
+ *       and EWMA weight; ignored when CMD=DESTROY. 
+ * @param[in,out] port_cntr_history_vs_ext - vendor specific 
+ *       extention
+ *
+ * @return EOS_STATUS_SUCCESS if operation completes successfully
+ * @return EOS_STATUS_PARAM_ERROR: Input parameters error. 
+ * @return EOS_STATUS_NO_RESOURCES if out of memory for the 
+ *         history
+ * @return OES_STATUS_ERROR general error. 
+ */
+oes_status_e
+oes_api_port_cntr_history_set(
+                             int br_id,
+                             enum oes_access_cmd cmd,
+                             struct oes_port_cntr_history_params * history_params,
+                             void * port_cntr_history_vs_ext
+                             );
+
+/**
+ * This function Retrieves the counter deltas, rates and EWMA 
+ * rates of a port counter group from the counter history. All 
+ * the counter fields of the group are computed together, 
+ * element i of each array refers to field i of the group 
+ * counters structure. Deltas and rates are computed over a 
+ * window of the last interval_cnt intervals of the history, 
+ * between the newest snapshot and the one interval_cnt 
+ * snapshots older. The EWMA rate does not depend on the 
+ * window. 
+ *  
+ * @param[in] br_id - Bridge id 
+ * @param[in] log_port - Logical Port ID. 
+ * @param[in] cntr_grp - counter group, one of the groups of the 
+ *       history. 
+ * @param[in] interval_cnt - window size in intervals, 
+ *       1 to depth - 1. 
+ * @param[in,out] cntr_rate - In: arrays Out: deltas, rates and 
+ *       EWMA rates
+ * @param[in,out] port_cntr_rate_vs_ext - vendor specific 
+ *       extention
+ *
+ * @return EOS_STATUS_SUCCESS if operation completes successfully
+ * @return EOS_STATUS_PARAM_ERROR: Input parameters error. 
+ * @return EOS_STATUS_PARAM_EXCEEDS_RANGE if interval_cnt is not 
+ *         smaller than the history depth.
+ * @return EOS_STATUS_ENTRY_NOT_FOUND if the group is not in the 
+ *         history or less than interval_cnt + 1 snapshots were 
+ *         taken.
+ * @return OES_STATUS_ERROR general error. 
+ */
+oes_status_e
+oes_api_port_cntr_rate_get(
+                          int br_id,
+                          unsigned long log_port,
+                          enum oes_port_cntr_grp cntr_grp,
+                          unsigned int interval_cnt,
+                          struct oes_port_cntr_rate * cntr_rate,
+                          void * port_cntr_rate_vs_ext
+                          );
+
 
 
 /**
  * This function Binds / Un-binds a policer to / from a port
  * Cannot bind policer to LAG member port
+ * The policer is created by oes_api_policer_set.
  *
  * @param[in] br_id - Bridge id
  * @param[in] cmd - EOS_ACCESS_CMD_BIND: bind a policer to port.
@@ -488,6 +757,8 @@ oes_api_port_policer_bind_set(
  * set user may EDIT the sflow parameters  
  * of a configured port. In order to remove sFlow 
  * sampling from the port use access cmd DESTROY. 
+ * The sampled packets are exported by the sFlow agent, see 
+ * oes_api_sflow_agent_set. 
  *  
  * @param[in] br_id - Bridge id 
  * @param[in] cmd - access cmd (CREATE/DESTROY/EDIT) 
@@ -582,6 +853,11 @@ oes_api_port_loopback_filter_get(
  * Add - add ports to isolation group (additionally to previous configuration)
  * Delete - remove ports from isolation group
  * Delete All - empty isolation group
+ * The isolation configuration of the bridge is kept as a port by
+ * port bitmap, row n holds the ports logical port n may transmit
+ * to. ADD and DELETE update only the bitmap words of the listed
+ * ports. SET and DELETE_ALL rewrite the log_port bit of every
+ * row.
  * 
  * @param[in] access_cmd - SET/ADD/DELETE/DELETE_ALL 
  * @param[in] br_id -bridge ID  
@@ -630,4 +906,59 @@ oes_api_port_isolation_get(
                           void * port_isolation_vs_ext
 		                  );
 
+/**
+ * This function retrieves the egress mask of the port, the ports
+ * traffic received on log_port may be transmitted to according
+ * to the isolation configuration. Bit n of word n / 64 refers to
+ * logical port n. The mask is a single row of the isolation
+ * bitmap.
+ * 
+ * @param[in] br_id - Bridge id 
+ * @param[in] log_port - Logical Port ID. 
+ * @param[out] egress_mask - allowed egress ports bitmap
+ * @param[in] mask_len - number of 64 bit words of egress_mask
+ * @param[in,out] port_isolation_vs_ext - vendor specific 
+ *       extention
+ *
+ * @return EOS_STATUS_SUCCESS - Operation completes successfully. 
+ * @return EOS_STATUS_PARAM_ERROR - Parameter is invalid.
+ * @return EOS_STATUS_PARAM_EXCEEDS_RANGE if egress_mask can not 
+ *         hold the highest logical port.
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e
+oes_api_port_isolation_mask_get(
+                               int br_id,
+                               unsigned long  log_port,
+                               unsigned long long * egress_mask,
+                               unsigned int mask_len,
+                               void * port_isolation_vs_ext
+                               );
+
+/**
+ * This function checks whether traffic received on a port may 
+ * be transmitted to another port according to the isolation 
+ * configuration. The check is a single bitmap bit test.
+ * 
+ * @param[in] br_id - Bridge id 
+ * @param[in] ingress_log_port - ingress Logical Port ID. 
+ * @param[in] egress_log_port - egress Logical Port ID. 
+ * @param[out] allowed - 1 if egress_log_port is not isolated 
+ *       from ingress_log_port.
+ * @param[in,out] port_isolation_vs_ext - vendor specific 
+ *       extention
+ *
+ * @return EOS_STATUS_SUCCESS - Operation completes successfully. 
+ * @return EOS_STATUS_PARAM_ERROR - Parameter is invalid.
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e
+oes_api_port_isolation_check(
+                            int br_id,
+                            unsigned long  ingress_log_port,
+                            unsigned long  egress_log_port,
+                            unsigned char * allowed,
+                            void * port_isolation_vs_ext
+                            );
+
 #endif /* __EOS_API_PORT_H__ */
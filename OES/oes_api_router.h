@@ -107,12 +107,148 @@ oes_api_router_ecmp_hash_params_get(
                                    void * router_ecmp_hash_vs_ext
                                    );
 
+/**
+ * This function computes, in software, the ECMP hash of a list 
+ * of flows and the group member each flow is forwarded to, as 
+ * the device does with the given hash configuration. Flows are 
+ * hashed in batches with the CPU CRC instructions when they are 
+ * available, struct oes_router_flow has no padding so a batch 
+ * is hashed as a flat byte array. The member of a flow is 
+ * hash % member_cnt. The model covers modulo hashing only, it 
+ * does not predict the member of a route using resilient 
+ * hashing (oes_api_router_ecmp_resilient_set). 
+ *  
+ * @param[in] vrid - Virtual router ID 
+ * @param[in] ecmp_hash_params - ECMP hash configuration, NULL 
+ *       for the configuration of vrid.
+ * @param[in] flow_list - flows array 
+ * @param[in] flow_cnt - flows array size 
+ * @param[in] member_cnt - number of ECMP group members 
+ * @param[out] hash_list - hash of each flow, may be NULL 
+ * @param[out] member_list - member index of each flow, in 
+ *       [0, member_cnt), may be NULL
+ * @param[in,out] router_ecmp_hash_vs_ext- vendor specific 
+ *       extension
+ *
+ * @return OES_STATUS_SUCCESS if operation completes successfully.
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid. 
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e
+oes_api_router_ecmp_hash_calc(
+                             unsigned int   vrid,
+                             struct oes_router_ecmp_hash_fields * ecmp_hash_params,
+                             struct oes_router_flow * flow_list,
+                             unsigned int   flow_cnt,
+                             unsigned short   member_cnt,
+                             unsigned int * hash_list,
+                             unsigned short * member_list,
+                             void * router_ecmp_hash_vs_ext
+                             );
+
+/**
+ * This function computes how a list of flows is spread over the 
+ * members of an ECMP group with the given hash configuration. 
+ * Members are selected as by oes_api_router_ecmp_hash_calc. 
+ * When flow_cnt is 0 all the balance fields are 0. 
+ *  
+ * @param[in] vrid - Virtual router ID 
+ * @param[in] ecmp_hash_params - ECMP hash configuration, NULL 
+ *       for the configuration of vrid.
+ * @param[in] flow_list - flows array 
+ * @param[in] flow_cnt - flows array size 
+ * @param[in] member_cnt - number of ECMP group members 
+ * @param[out] member_flow_cnt_list - number of flows of each 
+ *       member, array of member_cnt elements, may be NULL
+ * @param[out] balance - flow spread summary 
+ * @param[in,out] router_ecmp_hash_vs_ext- vendor specific 
+ *       extension
+ *
+ * @return OES_STATUS_SUCCESS if operation completes successfully.
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid. 
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e
+oes_api_router_ecmp_balance_get(
+                               unsigned int   vrid,
+                               struct oes_router_ecmp_hash_fields * ecmp_hash_params,
+                               struct oes_router_flow * flow_list,
+                               unsigned int   flow_cnt,
+                               unsigned short   member_cnt,
+                               unsigned int * member_flow_cnt_list,
+                               struct oes_router_ecmp_balance * balance,
+                               void * router_ecmp_hash_vs_ext
+                               );
+
+/**
+ * This function enables/disables resilient hashing for the ECMP 
+ * routes of a virtual router. With resilient hashing the flows 
+ * of an ECMP route are mapped to a table of bucket_cnt buckets, 
+ * each bucket pointing to one member of the next hop list. When 
+ * oes_api_router_uc_route_set removes a next hop, only the 
+ * buckets of the removed next hop are moved to the remaining 
+ * ones. When it adds a next hop, the new next hop takes an even 
+ * share of buckets from the existing ones. Flows of all other 
+ * buckets keep their next hop. 
+ * Two routes with the same next hop set may have different 
+ * bucket tables after different next hop changes, FIB 
+ * compression (oes_api_router_fib_compress_set) merges ECMP 
+ * routes only when their bucket tables are identical, so 
+ * forwarding is not changed by compression. 
+ *  
+ * @param[in] access_cmd - ENABLE/DISABLE. 
+ * @param[in] vrid - Virtual router ID 
+ * @param[in] bucket_cnt - number of buckets of each ECMP route, 
+ *       power of 2, ignored when cmd is DISABLE.
+ * @param[in,out] router_ecmp_resilient_vs_ext- vendor specific 
+ *       extension
+ *
+ * @return OES_STATUS_SUCCESS if operation completes successfully.
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid. 
+ * @return OES_STATUS_NO_RESOURCES if there are no resources for 
+ *         the bucket tables of the existing routes.
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e
+oes_api_router_ecmp_resilient_set(
+                                 enum oes_access_cmd access_cmd,
+                                 unsigned int   vrid,
+                                 unsigned int   bucket_cnt,
+                                 void * router_ecmp_resilient_vs_ext
+                                 );
+
+/**
+ * This function gets the resilient hashing configuration of a 
+ * virtual router. 
+ *  
+ * @param[in] vrid - Virtual router ID 
+ * @param[out] enable - 1 if resilient hashing is enabled. 
+ * @param[out] bucket_cnt - number of buckets of each ECMP route.
+ * @param[in,out] router_ecmp_resilient_vs_ext- vendor specific 
+ *       extension
+ *
+ * @return OES_STATUS_SUCCESS if operation completes successfully.
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid. 
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e
+oes_api_router_ecmp_resilient_get(
+                                 unsigned int   vrid,
+                                 unsigned char * enable,
+                                 unsigned int * bucket_cnt,
+                                 void * router_ecmp_resilient_vs_ext
+                                 );
+
 /**
  *  This function adds/modifies/deletes a virtual router.
  *  The router ID is allocated and returned to the caller when
  *  cmd is ADD, otherwise it is given by the caller. All
  *  interfaces and routes associated with a router must be
  *  deleted before the router can be deleted as well.
+ *  Creating a router allocates only its fixed state. The FIB
+ *  roots, neighbour table and router interface map of each IP
+ *  version are allocated on first use, grow with the number of
+ *  entries they hold and are released when they become empty.
  *  
  * @param[in] access_cmd - ADD/EDIT/DELETE. 
  * @param[in,out] vrid - Virtual router ID 
@@ -155,10 +291,119 @@ oes_api_router_get(
                   );
 
 
+/**
+ *  This function gets the memory used by a virtual router,
+ *  broken down per table. Only memory actually allocated for
+ *  the router is reported, an empty router reports base_bytes
+ *  only.
+ *  
+ * @param[in] vrid - Virtual router ID
+ * @param[out] mem_usage - memory usage in bytes.
+ * @param[in,out] router_mem_usage_vs_ext- vendor specific 
+ *       extension
+ *  
+ * @return OES_STATUS_SUCCESS if operation completes successfully. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid. 
+ * @return OES_STATUS_ENTRY_NOT_FOUND if router was not added.
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e
+oes_api_router_mem_usage_get(
+                            unsigned int   vrid,
+                            struct oes_router_mem_usage * mem_usage,
+                            void * router_mem_usage_vs_ext
+                            );
+
+
+/**
+ *  This function converts an IP address or prefix into its
+ *  canonical key. The key is 20 bytes with no padding, the
+ *  address bits beyond prefix_len and all unused bytes are
+ *  zeroed, so two keys are equal if and only if their bytes are
+ *  equal. A host address (neighbour, next hop) is encoded with
+ *  the full address length, 32 for IPv4 and 128 for IPv6, and
+ *  prefix_len 0 is the default route. The neighbour, unicast and
+ *  multicast route tables are keyed by this form.
+ *  
+ * @param[in] ip_addr - IP address.
+ * @param[in] prefix_len - prefix length, 32 (IPv4) or 128 
+ *       (IPv6) for a host address, 0 for the default route.
+ * @param[out] ip_key - canonical key.
+ *  
+ * @return OES_STATUS_SUCCESS if operation completes successfully. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid. 
+ * @return OES_STATUS_PARAM_EXCEEDS_RANGE if prefix_len exceeds the 
+ *         address length.
+ */
+oes_status_e
+oes_api_router_ip_key_from_addr(
+                               struct oes_ip_addr * ip_addr,
+                               unsigned int   prefix_len,
+                               struct oes_ip_key * ip_key
+                               );
+
+/**
+ *  This function converts a canonical key back into an IP
+ *  address and prefix length.
+ *  
+ * @param[in] ip_key - canonical key.
+ * @param[out] ip_addr - IP address.
+ * @param[out] prefix_len - prefix length, 32 (IPv4) or 128 
+ *       (IPv6) for a host address, 0 for the default route.
+ *  
+ * @return OES_STATUS_SUCCESS if operation completes successfully. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid. 
+ */
+oes_status_e
+oes_api_router_ip_key_to_addr(
+                             struct oes_ip_key * ip_key,
+                             struct oes_ip_addr * ip_addr,
+                             unsigned int * prefix_len
+                             );
+
+/**
+ *  This function computes the hash of a canonical key. The hash
+ *  covers the 20 key bytes as five 32 bit words and is the hash
+ *  used by the neighbour and route tables.
+ *  
+ * @param[in] ip_key - canonical key.
+ * @param[out] hash - key hash.
+ *  
+ * @return OES_STATUS_SUCCESS if operation completes successfully. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid. 
+ */
+oes_status_e
+oes_api_router_ip_key_hash(
+                          struct oes_ip_key * ip_key,
+                          unsigned int * hash
+                          );
+
+/**
+ *  This function compares two canonical keys. Keys are ordered
+ *  by version, then address, then prefix length, which is the
+ *  order routes are returned by GET_NEXT and by the dump.
+ *  
+ * @param[in] ip_key_a - first key.
+ * @param[in] ip_key_b - second key.
+ * @param[out] result - <0, 0, >0 when ip_key_a is lower than, 
+ *       equal to or greater than ip_key_b.
+ *  
+ * @return OES_STATUS_SUCCESS if operation completes successfully. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid. 
+ */
+oes_status_e
+oes_api_router_ip_key_cmp(
+                         struct oes_ip_key * ip_key_a,
+                         struct oes_ip_key * ip_key_b,
+                         int * result
+                         );
+
+
 /**
  *  This function adds/modifies/deletes/delete_all a router
  *  interface. A router interface is associated with L2
- *  interface.
+ *  interface. The (br_id, vlan) and port to rif indexes used by
+ *  oes_api_router_interface_lookup are updated by this call.
  * 
  * @param[in] access_cmd - ADD/EDIT/DELETE/DELETE ALL.
  * @param[in] vrid - Virtual Router ID. 
@@ -211,6 +456,33 @@ oes_api_router_interface_get(
                             void * router_interface_vs_ext
                             );
 
+/**
+ * This function gets the router interface associated with an 
+ * L2 interface, (br_id, vlan) for a VLAN interface or port for 
+ * a router port. The library keeps arrays indexed directly by 
+ * (br_id, vlan) and by port, so the lookup is a single array 
+ * access. 
+ * 
+ * @param[in] ifc - Interface type and parameters
+ * @param[out] vrid - Virtual Router ID. 
+ * @param[out] rif - Router Interface ID.  
+ * @param[in,out] router_interface_lookup_vs_ext- vendor 
+ *       specific extension
+ *
+ * @return OES_STATUS_SUCCESS if operation completes successfully. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return OES_STATUS_ENTRY_NOT_FOUND if no router interface is 
+ *         associated with the L2 interface.
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e
+oes_api_router_interface_lookup(
+                               struct oes_l3_interface * ifc,
+                               unsigned int * vrid,
+                               unsigned int * rif,
+                               void * router_interface_lookup_vs_ext
+                               );
+
 /**
  *  This function sets admin state of a router interface. Admin state is set per
  *  IP version.
@@ -261,6 +533,8 @@ oes_api_router_interface_state_set(
 
 /**
  *  This function adds/deletes a MAC address from a router interface.
+ *  The addresses are kept in the global router MAC table used by
+ *  oes_api_router_my_mac_lookup.
  * 
  * @param[in] access_cmd - ADD/DELETE/DELETE_ALL. 
  * @param[in] vrid - Virtual Router ID. 
@@ -309,6 +583,69 @@ oes_api_router_interface_mac_get(
                                 void * router_interface_mac_vs_ext
                                 );
 
+/**
+ *  This function adds/deletes a list of router MAC addresses,
+ *  of any router interfaces, in a single call. All entries are
+ *  validated first, if any entry is invalid nothing is applied
+ *  and the invalid entries are marked in status_list. An entry
+ *  which fails while applied does not stop the others, the
+ *  result of each entry is returned in status_list.
+ * 
+ * @param[in] access_cmd - ADD/DELETE. 
+ * @param[in] my_mac_list - (vrid, rif, MAC address) array.
+ * @param[in] my_mac_cnt - array size.
+ * @param[out] status_list - status of each entry, array of 
+ *       my_mac_cnt elements
+ * @param[in,out] router_my_mac_vs_ext- vendor specific
+ *       extension
+ *  
+ * @return OES_STATUS_SUCCESS if all entries completed successfully. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter or entry 
+ *         is invalid, see status_list. Nothing was applied.
+ * @return OES_STATUS_ERROR if at least one entry failed while 
+ *         applied, see status_list. The other entries were 
+ *         applied.
+ */
+oes_status_e
+oes_api_router_my_mac_bulk_set(
+                              enum oes_access_cmd access_cmd,
+                              struct oes_router_my_mac_entry * my_mac_list,
+                              unsigned int   my_mac_cnt,
+                              oes_status_e * status_list,
+                              void * router_my_mac_vs_ext
+                              );
+
+/**
+ *  This function checks whether a destination MAC address
+ *  received on an L2 interface is a router MAC address, and
+ *  returns the router interface it belongs to. The router MAC
+ *  table is hashed on (L2 interface, MAC address), the lookup
+ *  does not depend on the number of router interfaces or MAC
+ *  addresses.
+ * 
+ * @param[in] ifc - Interface type and parameters, (br_id, vlan) 
+ *       or port
+ * @param[in] mac_addr - destination MAC address.
+ * @param[out] vrid - Virtual Router ID. 
+ * @param[out] rif - Router Interface ID.
+ * @param[in,out] router_my_mac_vs_ext- vendor specific
+ *       extension
+ *  
+ * @return OES_STATUS_SUCCESS if mac_addr is a router MAC address. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return OES_STATUS_ENTRY_NOT_FOUND if mac_addr is not a router 
+ *         MAC address of the L2 interface.
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e
+oes_api_router_my_mac_lookup(
+                            struct oes_l3_interface * ifc,
+                            struct ether_addr * mac_addr,
+                            unsigned int * vrid,
+                            unsigned int * rif,
+                            void * router_my_mac_vs_ext
+                            );
+
 /**
  *  This function adds/modifies/deletes/delete_all a neighbour
  *  information. The neighbour information associate an IP
@@ -343,6 +680,45 @@ oes_api_router_neigh_set(
                         void * router_neigh_vs_ext
                         );
 
+/**
+ *  This function adds/modifies/deletes a list of neighbours in
+ *  a single call. All entries are validated first, if any entry
+ *  is invalid nothing is applied and the invalid entries are
+ *  marked in status_list. The entries are then written to the
+ *  device in grouped writes, an entry which fails while written
+ *  does not stop the others, the result of each entry is
+ *  returned in status_list.
+ * 
+ * @param[in] access_cmd - ADD/EDIT/DELETE.
+ * @param[in] vrid - Virtual Router ID. 
+ * @param[in] neigh_key_list - neigh IP address array 
+ * @param[in] neigh_data_list- neigh data array, each neigh data 
+ *       element includes rif,mac address,
+ *       action(TRAP/DROP/FORWARD) ,activity
+ * @param[in] neigh_cnt - array size  
+ * @param[out] status_list - status of each entry, array of 
+ *       neigh_cnt elements
+ * @param[in,out] router_neigh_vs_ext- vendor specific extension
+ *
+ * @return OES_STATUS_SUCCESS if all entries completed successfully. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter or entry 
+ *         is invalid, see status_list. Nothing was applied. 
+ * @return OES_STATUS_ERROR if at least one entry failed while 
+ *         applied, see status_list. The other entries were 
+ *         applied.
+ */
+
+oes_status_e 
+oes_api_router_neigh_bulk_set(
+                             enum oes_access_cmd access_cmd,
+                             unsigned int   vrid,
+                             struct oes_ip_addr  * neigh_key_list,
+                             struct oes_neigh_data * neigh_data_list,
+                             unsigned int   neigh_cnt,
+                             oes_status_e * status_list,
+                             void * router_neigh_vs_ext
+                             );
+
 /**
  *  This function gets/get activity a neighbour information.
  *  function can receive four types of input: 
@@ -473,6 +849,213 @@ oes_api_router_uc_route_get(
                            void * router_uc_route_vs_ext
                            );
 
+/**
+ * This function dumps the unicast routing table of a virtual 
+ * router into caller supplied buffers. Each call fills as many 
+ * routes as fit in entry_list and next_hop_list and advances 
+ * the cursor, the next call resumes right after the last 
+ * returned route. Routes added or deleted between calls are 
+ * returned or skipped according to their position relative to 
+ * the cursor, the dump never returns a route twice. 
+ * Entries have a fixed size and refer to their next hops by 
+ * index into next_hop_list, so the buffers can be scanned 
+ * sequentially. 
+ * A zeroed cursor starts the dump from the first route, 
+ * cursor->done is set once the whole table was returned. 
+ *  
+ * @param[in] vrid - Virtual Router ID.
+ * @param[in,out] cursor - dump position.
+ * @param[out] entry_list - route entries array 
+ * @param[in,out] entry_cnt - In: array size Out: number of 
+ *       entries filled.
+ * @param[out] next_hop_list - next hops array of the returned 
+ *       routes
+ * @param[in,out] next_hop_cnt - In: array size Out: number of 
+ *       next hops filled.
+ * @param[in,out] router_uc_route_dump_vs_ext- vendor specific 
+ *       extension
+ *  
+ * @return OES_STATUS_SUCCESS if operation completes successfully. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return OES_STATUS_PARAM_EXCEEDS_RANGE if next_hop_list can not 
+ *         hold the next hops of a single route.
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e 
+oes_api_router_uc_route_dump(
+                            unsigned int   vrid,
+                            struct oes_uc_route_dump_cursor * cursor,
+                            struct oes_uc_route_dump_entry * entry_list,
+                            unsigned int * entry_cnt,
+                            struct oes_ip_addr * next_hop_list,
+                            unsigned int * next_hop_cnt,
+                            void * router_uc_route_dump_vs_ext
+                            );
+
+/**
+ * This function looks up a list of destination addresses in 
+ * the unicast routing table of a virtual router (longest prefix 
+ * match), and returns the matched route of each one. 
+ * fib_table selects the table searched: PROGRAMMED matches as 
+ * the device does and, when FIB compression is enabled, may 
+ * return an aggregated prefix which is not in the configured 
+ * table; CONFIGURED returns the route set by the user. When 
+ * compression is disabled both tables are the same. 
+ * The table is not modified and the device is 
+ * not accessed. Addresses are processed as a pipelined batch, 
+ * the table nodes of the following addresses are prefetched 
+ * while the current one is resolved, so large lists should be 
+ * passed in a single call. 
+ * For ECMP routes the first next hop of the route and the next 
+ * hop count are returned, next_hop is not the next hop a given 
+ * flow is forwarded to. Use oes_api_router_ecmp_hash_calc to 
+ * find the member selected for a flow. 
+ *  
+ * @param[in] vrid - Virtual Router ID.
+ * @param[in] fib_table - CONFIGURED/PROGRAMMED. 
+ * @param[in] dst_addr_list - destination IP address array 
+ * @param[out] result_list - lookup results array, one element 
+ *       per destination address
+ * @param[in] addr_cnt - array size 
+ * @param[in,out] router_uc_route_lookup_vs_ext- vendor specific 
+ *       extension
+ *  
+ * @return OES_STATUS_SUCCESS if operation completes successfully. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e 
+oes_api_router_uc_route_lookup(
+                              unsigned int   vrid,
+                              enum oes_router_fib_table fib_table,
+                              struct oes_ip_addr * dst_addr_list,
+                              struct oes_uc_route_lookup_result * result_list,
+                              unsigned int   addr_cnt,
+                              void * router_uc_route_lookup_vs_ext
+                              );
+
+/**
+ * This function computes the hash of a unicast route, the hash 
+ * summed by oes_api_router_uc_route_digest_get. The hash covers 
+ * the route key, the action and the next hop set, next hops are 
+ * hashed one by one and summed so their order does not matter. 
+ * It is used to compute, from a device table dump, a digest 
+ * comparable with the library digest. 
+ *  
+ * @param[in] uc_route_key - route canonical key.
+ * @param[in] uc_route_data - route action and next hop list.
+ * @param[out] hash - route hash.
+ *  
+ * @return OES_STATUS_SUCCESS if operation completes successfully. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid.
+ */
+oes_status_e 
+oes_api_router_uc_route_hash(
+                            struct oes_ip_key * uc_route_key,
+                            struct oes_uc_route_data * uc_route_data,
+                            unsigned long long * hash
+                            );
+
+/**
+ * This function gets the digest of the unicast routes of a 
+ * virtual router whose keys are within [first_key, last_key]. 
+ * The digest is the sum modulo 2^64 of the 
+ * oes_api_router_uc_route_hash of every route in the range, so 
+ * it does not depend on the order routes were added. The 
+ * digest is updated on every route change and kept per subtree 
+ * of the routing table, getting the digest of the whole table 
+ * costs O(1) and of any range O(log n). 
+ * When FIB compression is enabled the device holds the 
+ * aggregated routes, fib_table selects whether the digest 
+ * covers the configured routes or the programmed ones. Only the 
+ * PROGRAMMED digest is comparable with the device table, when 
+ * compression is disabled both tables are the same. 
+ * Comparing the digest with the one computed over the device 
+ * table finds a mismatch, splitting the range in two and 
+ * comparing again narrows it down to the mismatching routes. 
+ * Keys are ordered as by oes_api_router_ip_key_cmp, NULL 
+ * first_key and last_key select the whole table. 
+ *  
+ * @param[in] vrid - Virtual Router ID.
+ * @param[in] fib_table - CONFIGURED/PROGRAMMED. 
+ * @param[in] first_key - first route key of the range.
+ * @param[in] last_key - last route key of the range.
+ * @param[out] digest - range digest and route count.
+ * @param[in,out] router_uc_route_digest_vs_ext- vendor specific 
+ *       extension
+ *  
+ * @return OES_STATUS_SUCCESS if operation completes successfully. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e 
+oes_api_router_uc_route_digest_get(
+                                  unsigned int   vrid,
+                                  enum oes_router_fib_table fib_table,
+                                  struct oes_ip_key * first_key,
+                                  struct oes_ip_key * last_key,
+                                  struct oes_uc_route_digest * digest,
+                                  void * router_uc_route_digest_vs_ext
+                                  );
+
+
+/**
+ *  This function enables/disables FIB compression of a virtual
+ *  router. When enabled, the unicast routes set by
+ *  oes_api_router_uc_route_set are aggregated before they are
+ *  written to the device: adjacent prefixes and prefixes
+ *  covered by a less specific one are merged when they have the
+ *  same action and the same next hop set (in any order), and
+ *  with resilient hashing the same bucket table. The
+ *  programmed table forwards every destination exactly as the
+ *  configured one. Route changes update the programmed table
+ *  incrementally, only the affected prefixes are rewritten.
+ *  oes_api_router_uc_route_get and oes_api_router_uc_route_dump
+ *  keep returning the configured routes, the activity of a
+ *  merged route is the activity of the entry it was merged
+ *  into.
+ *
+ * @param[in] access_cmd - ENABLE/DISABLE. 
+ * @param[in] vrid - Virtual Router ID. 
+ * @param[in,out] router_fib_compress_vs_ext- vendor specific 
+ *       extension
+ *  
+ * @return OES_STATUS_SUCCESS if operation completes successfully
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is 
+ *         invalid.
+ * @return OES_STATUS_NO_RESOURCES if the device table can not 
+ *         hold the routes when compression is disabled.
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e 
+oes_api_router_fib_compress_set(
+                               enum oes_access_cmd access_cmd, 
+                               unsigned int   vrid, 
+                               void * router_fib_compress_vs_ext
+                               );
+
+/**
+ *  This function gets the FIB compression state of a virtual
+ *  router and the number of configured and programmed routes.
+ *
+ * @param[in] vrid - Virtual Router ID. 
+ * @param[out] enable - 1 if FIB compression is enabled. 
+ * @param[out] stats - configured and programmed route count. 
+ * @param[in,out] router_fib_compress_vs_ext- vendor specific 
+ *       extension
+ *  
+ * @return OES_STATUS_SUCCESS if operation completes successfully
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is 
+ *         invalid.
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e 
+oes_api_router_fib_compress_get(
+                               unsigned int   vrid, 
+                               unsigned char * enable,
+                               struct oes_router_fib_compress_stats * stats,
+                               void * router_fib_compress_vs_ext
+                               );
 
 /**
  *  This function allocates/deallocates a router interface
@@ -500,6 +1083,11 @@ oes_api_router_interface_cntr_enable_set(
                                         );
 /**
  * This function reads router interface counter 
+ * The counters are kept in 64 bit software accumulators, the 
+ * device counters are read and cleared by the library only. 
+ * READ CLEAR moves the baseline of the default consumer 0 
+ * only, it does not affect the consumers of 
+ * oes_api_router_interface_cntr_bulk_get. 
  *
  * @param[in] access_cmd - READ/READ CLEAR. 
  * @param[in] vrid - Virtual Router ID. 
@@ -522,6 +1110,85 @@ oes_api_router_interface_cntr_get(
                                  void * router_interface_cntr_vs_ext
                                  );
 
+/**
+ * This function Creates / Destroys a router interface counters 
+ * consumer. Each consumer has its own clear baseline and its 
+ * own previous snapshot of every counter, so several pollers 
+ * reading in DELTA or RATE mode or clearing the counters do 
+ * not affect each other. Consumer 0 always exists and is the 
+ * consumer of oes_api_router_interface_cntr_get. 
+ *
+ * @param[in] access_cmd - CREATE/DESTROY. 
+ * @param[in,out] consumer_id - consumer ID, allocated and 
+ *       returned when cmd is CREATE.
+ * @param[in,out] router_cntr_consumer_vs_ext- vendor specific 
+ *       extension
+ *
+ * @return OES_STATUS_SUCCESS if operation completes successfully. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid. 
+ * @return OES_STATUS_NO_RESOURCES if no consumer is available 
+ *         to create.
+ * @return OES_STATUS_ERROR general error.
+ */
+oes_status_e 
+oes_api_router_cntr_consumer_set(
+                                enum oes_access_cmd access_cmd, 
+                                unsigned int * consumer_id,
+                                void * router_cntr_consumer_vs_ext
+                                );
+
+/**
+ * This function reads the counters of all the enabled router 
+ * interfaces of a virtual router, or of all virtual routers, 
+ * in a single call into a contiguous array. 
+ * Counters are read from the 64 bit software accumulators, 
+ * which never decrease: the device counters are cleared by the 
+ * library only, and READ CLEAR moves the clear baseline of 
+ * consumer_id only. A READ CLEAR through 
+ * oes_api_router_interface_cntr_get therefore does not change 
+ * the values seen here by other consumers. 
+ * In DELTA and RATE modes the library keeps the previous 
+ * snapshot of every counter per consumer and returns the 
+ * difference from it, READ CLEAR by the same consumer resets 
+ * its snapshot together with its baseline. 
+ * The snapshot of a rif is dropped when its counter is 
+ * disabled, the first snapshot after enable is returned with 
+ * delta_valid = 0. 
+ * When cntr_list is NULL, cntr_cnt is filled with the number 
+ * of enabled counters and no counter is read. 
+ *
+ * @param[in] access_cmd - READ/READ CLEAR. 
+ * @param[in] consumer_id - consumer ID, see 
+ *       oes_api_router_cntr_consumer_set.
+ * @param[in] vrid - Virtual Router ID, OES_ROUTER_VRID_ALL for 
+ *       all virtual routers.
+ * @param[in] cntr_mode - ABSOLUTE/DELTA/RATE. 
+ * @param[out] cntr_list - router interface counters array 
+ * @param[in,out] cntr_cnt - In: array size Out: number of 
+ *       entries filled.
+ * @param[in,out] router_interface_cntr_bulk_vs_ext- vendor 
+ *       specific extension
+ *
+ * @return OES_STATUS_SUCCESS if operation completes successfully. 
+ * @return OES_STATUS_PARAM_ERROR if any input parameter is invalid. 
+ * @return OES_STATUS_PARAM_EXCEEDS_RANGE if cntr_cnt is smaller 
+ *         than the number of enabled counters.
+ * @return OES_STATUS_ENTRY_NOT_FOUND if the consumer was not 
+ *         created.
+ * @return OES_STATUS_ERROR general error.
+ */
+
+oes_status_e 
+oes_api_router_interface_cntr_bulk_get(
+                                      enum oes_access_cmd access_cmd, 
+                                      unsigned int consumer_id,
+                                      unsigned int vrid,
+                                      enum oes_router_cntr_mode cntr_mode,
+                                      struct oes_router_cntr_bulk_entry * cntr_list,
+                                      unsigned int * cntr_cnt,
+                                      void * router_interface_cntr_bulk_vs_ext
+                                      );
+
 
 /**
 *  This function adds/ deletes a multicast route into/from the
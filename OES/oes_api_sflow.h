@@ -0,0 +1,171 @@
+/* This software is available to you under a choice of one of two
+* licenses.  You may choose to be licensed under the terms of the GNU
+* General Public License (GPL) Version 2, available from the file
+* COPYING, or the Open Ethernet BSD license below:
+*
+*     Redistribution and use in source and binary forms, with or
+*     without modification, are permitted provided that the following
+*     conditions are met:
+*
+*      - Redistributions of source code must retain the above
+*        copyright notice, this list of conditions and the following
+*        disclaimer.
+*
+*      - Redistributions in binary form must reproduce the above
+*        copyright notice, this list of conditions and the following
+*        disclaimer in the documentation and/or other materials
+*        provided with the distribution.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+* BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+* ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE. 
+*/
+
+#ifndef __OES_API_SFLOW_H__
+#define __OES_API_SFLOW_H__
+
+#include <oes_types.h>
+
+/************************************************
+ *  API functions
+ ***********************************************/
+
+
+/**
+ * This function sets the log verbosity level of sFlow MODULE
+ * @param[in]  verbosity_level  - sFlow module verbosity level
+ *
+ * @return OES_STATUS_SUCCESS - Operation completes successfully
+ * @return OES_STATUS_PARAM_ERROR - Unsupported verbosity_level
+ * @return OES_STATUS_ERROR general error. 
+ */
+oes_status_e
+oes_api_sflow_log_verbosity_level_set(
+                                     int   verbosity_level
+                                     );
+
+/**
+ * This function gets the log verbosity level of sFlow MODULE
+ * @param[out]  verbosity_level_p  - sFlow module verbosity 
+ *       level
+ *
+ * @return OES_STATUS_SUCCESS - Operation completes successfully
+ * @return OES_STATUS_PARAM_ERROR - Unsupported verbosity_level
+ * @return OES_STATUS_ERROR general error. 
+ */
+oes_status_e
+oes_api_sflow_log_verbosity_level_get(
+                                     int   * verbosity_level_p
+                                     );
+
+
+/**
+ *  This function sets the sFlow agent of a bridge. The agent
+ *  receives the packets sampled on the ports configured by
+ *  oes_api_port_sflow_set (OES_PACKET_PACKET_SAMPLING) through
+ *  a lock free queue per port, adds the port counters and
+ *  encodes sFlow version 5 datagrams into preallocated buffers.
+ *  Samples are encoded in batches, a datagram is sent when it
+ *  is full or when its oldest sample waited
+ *  flush_interval_msec.
+ *
+ * @param[in] br_id - Bridge id  
+ * @param[in] access_cmd - CREATE / EDIT / DESTROY 
+ * @param[in] agent_params - agent and collector parameters, 
+ *       ignored when cmd is DESTROY.
+ * @param[in,out] sflow_agent_vs_ext - vendor specific 
+ *       extention
+ * @return OES_STATUS_SUCCESS - Operation completes successfully
+ * @return OES_STATUS_PARAM_ERROR - Input parameters error. 
+ * @return OES_STATUS_NO_RESOURCES if the datagram buffers or 
+ *         port queues can not be allocated
+ * @return OES_STATUS_ERROR general error.  
+ */
+oes_status_e 
+oes_api_sflow_agent_set(
+                       int br_id,
+                       enum oes_access_cmd access_cmd,
+                       struct oes_sflow_agent_params * agent_params,
+                       void * sflow_agent_vs_ext
+                       );
+
+
+/**
+ *  This function gets the sFlow agent of a bridge.
+ *
+ * @param[in] br_id - Bridge id  
+ * @param[out] agent_params - agent and collector parameters.
+ * @param[in,out] sflow_agent_vs_ext - vendor specific 
+ *       extention
+ * @return OES_STATUS_SUCCESS - Operation completes successfully
+ * @return OES_STATUS_PARAM_ERROR - Input parameters error. 
+ * @return OES_STATUS_ENTRY_NOT_FOUND if no agent was created.
+ * @return OES_STATUS_ERROR general error.  
+ */
+oes_status_e 
+oes_api_sflow_agent_get(
+                       int br_id,
+                       struct oes_sflow_agent_params * agent_params,
+                       void * sflow_agent_vs_ext
+                       );
+
+
+/**
+ *  This function retrieves the sFlow agent statistics.
+ *
+ * @param[in] br_id - Bridge id  
+ * @param[in] access_cmd - READ/READ CLEAR 
+ * @param[out] agent_stats - agent statistics.
+ * @param[in,out] sflow_agent_stats_vs_ext - vendor specific 
+ *       extention
+ * @return OES_STATUS_SUCCESS - Operation completes successfully
+ * @return OES_STATUS_PARAM_ERROR - Input parameters error. 
+ * @return OES_STATUS_ENTRY_NOT_FOUND if no agent was created.
+ * @return OES_STATUS_ERROR general error.  
+ */
+oes_status_e 
+oes_api_sflow_agent_stats_get(
+                             int br_id,
+                             enum oes_access_cmd access_cmd,
+                             struct oes_sflow_agent_stats * agent_stats,
+                             void * sflow_agent_stats_vs_ext
+                             );
+
+
+/**
+ *  This function queues a sampled packet to the sFlow agent, as
+ *  the trap path does for OES_PACKET_PACKET_SAMPLING packets. It
+ *  can be used to feed the agent with packets from another
+ *  source, e.g. for testing. The packet is copied and the call
+ *  does not block, when the port queue is full the sample is
+ *  dropped and counted in sample_drop_cnt.
+ *
+ * @param[in] br_id - Bridge id  
+ * @param[in] log_port - ingress logical port 
+ * @param[in] packet - packet header bytes 
+ * @param[in] packet_len - number of bytes in packet 
+ * @param[in] frame_len - original frame length 
+ * @param[in,out] sflow_sample_vs_ext - vendor specific 
+ *       extention
+ * @return OES_STATUS_SUCCESS - Operation completes successfully
+ * @return OES_STATUS_PARAM_ERROR - Input parameters error. 
+ * @return OES_STATUS_NO_RESOURCES if the port queue is full 
+ * @return OES_STATUS_ERROR general error.  
+ */
+oes_status_e 
+oes_api_sflow_sample_enqueue(
+                            int br_id,
+                            unsigned long log_port,
+                            unsigned char * packet,
+                            unsigned short packet_len,
+                            unsigned int frame_len,
+                            void * sflow_sample_vs_ext
+                            );
+
+
+#endif /* __OES_API_SFLOW_H__ */
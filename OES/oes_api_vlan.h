@@ -56,6 +56,9 @@ oes_api_vlan_log_verbosity_level_get(int   * verbosity_level);
 
 /**
  *  This function sets the VLAN member ports.
+ *  The VLAN membership of the bridge is kept as a VLAN by port
+ *  bitmap indexed both ways, by VLAN (member ports) and by port
+ *  (member VLANs), with a tagged and an untagged plane.
  *
  * @param[in] access_cmd - ADD / DELETE / DELETE_ALL
  * @param[in] br_id - virtual switch partition id
@@ -136,6 +139,40 @@ oes_api_vlan_port_multi_vlan_set(
                                 void * vlan_list_vs_ext
                                 );
 
+/**
+*  This function sets ranges of VLANs to a list of ports in a
+*  single command. Each range is applied to the VLAN bitmap of
+*  each port with a range fill, O(range / 64) words, and to the
+*  port bitmap of each VLAN in the range with one bit write per
+*  VLAN, O(range), together with the update of the flood sets
+*  of these VLANs (oes_api_vlan_flood_mask_get).
+ * @param[in] br_id - virtual switch partition id
+* @param[in] access_cmd -  OES_ACCESS_CMD_ADD - Add the VLAN ranges to the ports
+*                          OES_ACCESS_CMD_DELETE - Remove the VLAN ranges from the ports
+*
+* @param[in] log_port_list_p - logical ports array
+* @param[in] port_num - size of ports array
+* @param[in] vlan_range_list_p - pointer to a list of (first 
+*       VLAN, last VLAN, tagged) tuples
+* @param[in] vlan_range_num - size of VLAN ranges list
+* @param[in,out] vlan_list_vs_ext - vlan list **** vendor 
+*       extension pointer*
+* 
+* @return OES_STATUS_SUCCESS if operation completes successfully
+* @return OES_STATUS_PARAM_ERROR if any input parameter is invalid
+* @return OES_STATUS_ERROR - Unexpected SDK error
+*/
+oes_status_e 
+oes_api_vlan_port_multi_vlan_range_set(
+                                      int br_id, 
+                                      enum oes_access_cmd access_cmd,
+                                      unsigned long * log_port_list_p,
+                                      unsigned short port_num,
+                                      struct oes_vlan_range * vlan_range_list_p,
+                                      unsigned short vlan_range_num,
+                                      void * vlan_list_vs_ext
+                                      );
+
 /**
 * This function enables/ disables ingress VLAN filtering on 
 *   port. The VLAN membership is defined in oes_vlan_ports_set
@@ -412,6 +449,44 @@ oes_api_vlan_flood_ports_get(
                             void * vlan_flood_vs_ext
                             );
 
+/**
+ *  This function gets the flood set of a VLAN, the ports a
+ *  packet of flood_type received on ingress_log_port in vid is
+ *  flooded to. The library keeps per vid and flood type a
+ *  compiled port bitmap combining the flood mode and flood ports
+ *  (oes_api_vlan_flood_mode_set, oes_api_vlan_flood_ports_set),
+ *  the VLAN membership and the port states in the MSTI of vid,
+ *  updated incrementally when any of them changes. The isolation
+ *  row of ingress_log_port is applied on the query and the
+ *  ingress port is removed, so the query costs one bitmap AND.
+ *  Bit n of word n / 64 refers to logical port n.
+ *  
+ * @param[in] br_id - virtual switch partition id
+ * @param[in] vid 	- filtering DB id
+ * @param[in] flood_type - unknown_uc/ unreg_mc/broadcast
+ * @param[in] ingress_log_port - ingress logical port
+ * @param[out] flood_mask - flood ports bitmap
+ * @param[in] mask_len - number of 64 bit words of flood_mask
+*  @param[in,out] vlan_flood_vs_ext - vlan flood 
+*        vendor extension pointer
+* 
+* @return OES_STATUS_SUCCESS if operation completes successfully
+* @return OES_STATUS_PARAM_ERROR if any input parameter is invalid
+* @return OES_STATUS_PARAM_EXCEEDS_RANGE if flood_mask can not 
+*         hold the highest logical port
+* @return OES_STATUS_ERROR - Unexpected SDK error
+ */
+oes_status_e
+oes_api_vlan_flood_mask_get(
+                           int br_id, 
+                           unsigned short vid,
+                           enum oes_vlan_flood_type flood_type, 
+                           unsigned long ingress_log_port,
+                           unsigned long long * flood_mask,
+                           unsigned int mask_len,
+                           void * vlan_flood_vs_ext
+                           );
+
 /**
  *  This function set Q-in-Q mode of port
  *
@@ -497,6 +572,88 @@ oes_api_vlan_qinq_outer_prio_mode_get(
                                      void * qinq_prio_mode_vs_ext
                                      );
 
+/**
+ *  This function gets the member ports of a VLAN as bitmaps.
+ *  Bit n of word n / 64 refers to logical port n.
+ *
+ * @param[in] br_id - virtual switch partition id
+ * @param[in] vid - VLAN id
+ * @param[out] member_mask - member ports bitmap
+ * @param[out] untagged_mask - untagged member ports bitmap, may 
+ *       be NULL
+ * @param[in] mask_len - number of 64 bit words of each bitmap
+*  @param[in,out] vlan_member_vs_ext - vlan member 
+*        vendor extension pointer
+* 
+* @return OES_STATUS_SUCCESS if operation completes successfully
+* @return OES_STATUS_PARAM_ERROR if any input parameter is invalid
+* @return OES_STATUS_PARAM_EXCEEDS_RANGE if the bitmaps can not 
+*         hold the highest logical port
+* @return OES_STATUS_ERROR - Unexpected SDK error
+ */
+oes_status_e
+oes_api_vlan_member_mask_get(
+                            int br_id, 
+                            unsigned short vid,
+                            unsigned long long * member_mask,
+                            unsigned long long * untagged_mask,
+                            unsigned int mask_len,
+                            void * vlan_member_vs_ext
+                            );
+
+/**
+ *  This function gets the VLANs a port is member of as bitmaps.
+ *  Bit n of word n / 64 refers to VLAN id n, each bitmap is 64
+ *  words long (VLAN ids 0-4095).
+ *
+ * @param[in] br_id - virtual switch partition id
+ * @param[in] log_port - logical port number
+ * @param[out] vid_mask - member VLANs bitmap
+ * @param[out] untagged_vid_mask - VLANs the port is an untagged 
+ *       member of, may be NULL
+*  @param[in,out] vlan_member_vs_ext - vlan member 
+*        vendor extension pointer
+* 
+* @return OES_STATUS_SUCCESS if operation completes successfully
+* @return OES_STATUS_PARAM_ERROR if any input parameter is invalid
+* @return OES_STATUS_ERROR - Unexpected SDK error
+ */
+oes_status_e
+oes_api_vlan_port_vid_mask_get(
+                              int br_id, 
+                              unsigned long log_port,
+                              unsigned long long vid_mask[64],
+                              unsigned long long untagged_vid_mask[64],
+                              void * vlan_member_vs_ext
+                              );
+
+/**
+ *  This function checks whether a port is a member of a VLAN.
+ *  The check is a single bitmap bit test.
+ *
+ * @param[in] br_id - virtual switch partition id
+ * @param[in] vid - VLAN id
+ * @param[in] log_port - logical port number
+ * @param[out] member - 1 if log_port is a member of vid
+ * @param[out] tagged - 1 if log_port is a tagged member of vid, 
+ *       may be NULL
+*  @param[in,out] vlan_member_vs_ext - vlan member 
+*        vendor extension pointer
+* 
+* @return OES_STATUS_SUCCESS if operation completes successfully
+* @return OES_STATUS_PARAM_ERROR if any input parameter is invalid
+* @return OES_STATUS_ERROR - Unexpected SDK error
+ */
+oes_status_e
+oes_api_vlan_port_member_get(
+                            int br_id, 
+                            unsigned short vid,
+                            unsigned long log_port,
+                            unsigned char * member,
+                            unsigned char * tagged,
+                            void * vlan_member_vs_ext
+                            );
+
 
 #endif /* __OES_API_VLAN_H__ */
 
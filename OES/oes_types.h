@@ -26,6 +26,11 @@
 * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 * SOFTWARE. 
 */
+/************************************************************************************************************/
+/**************************** define **********************************************************************/
+
+#define OES_ROUTER_VRID_ALL		0xFFFFFFFF	/**< all virtual routers, valid in bulk APIs only */
+
 /************************************************************************************************************/
 /**************************** enum ************************************************************************/
 
@@ -86,6 +91,47 @@ enum oes_port_oper_state{
 };
 
 
+enum oes_port_cntr_grp {
+	OES_PORT_CNTR_GRP_IEEE_802_DOT_3	= 1 << 0,
+	OES_PORT_CNTR_GRP_RFC_2863		= 1 << 1,
+	OES_PORT_CNTR_GRP_RFC_2819		= 1 << 2,
+	OES_PORT_CNTR_GRP_RFC_3635		= 1 << 3,
+};
+
+enum oes_port_cfg_field {
+	OES_PORT_CFG_FIELD_MTU			= 1 << 0,
+	OES_PORT_CFG_FIELD_ADMIN_STATE		= 1 << 1,
+	OES_PORT_CFG_FIELD_SPEED_CAPABILITY	= 1 << 2,
+	OES_PORT_CFG_FIELD_FLOW_CTRL		= 1 << 3,
+	OES_PORT_CFG_FIELD_PVID			= 1 << 4,
+};
+
+enum oes_policer_mode {
+	OES_POLICER_MODE_SR_TCM,	/**< single rate three color marker (RFC 2697) */
+	OES_POLICER_MODE_TR_TCM,	/**< two rate three color marker (RFC 2698) */
+};
+
+enum oes_policer_meter_type {
+	OES_POLICER_METER_BYTES,	/**< rates in bits per second, bursts in bytes */
+	OES_POLICER_METER_PACKETS,	/**< rates in packets per second, bursts in packets */
+};
+
+enum oes_policer_color {
+	OES_POLICER_COLOR_GREEN,
+	OES_POLICER_COLOR_YELLOW,
+	OES_POLICER_COLOR_RED,
+};
+
+enum oes_policer_action {
+	OES_POLICER_ACTION_FORWARD,	/**< forward the packet with its color */
+	OES_POLICER_ACTION_DROP,	/**< drop the packet */
+};
+
+enum oes_sflow_collector_type {
+	OES_SFLOW_COLLECTOR_UDP,	/**< datagrams are sent to a UDP collector */
+	OES_SFLOW_COLLECTOR_FILE,	/**< datagrams are appended to a file */
+};
+
 enum oes_port_phys_loopback {
     OES_EXTERNAL_LOOPBACK, 
     OES_INTERNAL_LOOPBACK,
@@ -139,6 +185,17 @@ enum oes_interface_type {
 	OES_INTERFACE_TYPE_ROUTER_PORT,
 };
 
+enum oes_router_cntr_mode {
+	OES_ROUTER_CNTR_MODE_ABSOLUTE,	/**< counter values as read from the device */
+	OES_ROUTER_CNTR_MODE_DELTA,	/**< difference from the previous bulk snapshot */
+	OES_ROUTER_CNTR_MODE_RATE,	/**< difference and per second rate */
+};
+
+enum oes_router_fib_table {
+	OES_ROUTER_FIB_TABLE_CONFIGURED,	/**< routes set by oes_api_router_uc_route_set */
+	OES_ROUTER_FIB_TABLE_PROGRAMMED,	/**< routes written to the device, after FIB compression */
+};
+
 enum oes_ip_version {
 	OES_IPV4,
 	OES_IPV6,
@@ -149,6 +206,7 @@ enum oes_ip_version {
 enum oes_event{
 	OES_EVENT_ID_FDB,/**< FDB learning and aging event */
 	OES_EVENT_ID_PORT,/**< port up/down*/
+	OES_EVENT_ID_PORT_DAMPING,/**< port flap damping suppress/reuse summary */
 };
 	
 enum oes_l2_packet{
@@ -224,6 +282,12 @@ struct oes_fdb_uc_mac_addr_params {
 	enum oes_fdb_mac_entry_type entry_type;  /**< FDB Entry Type (dynamic/static)*/
 };
 
+struct oes_vlan_range {
+	unsigned short  first_vid;	/**< first VLAN id of the range */
+	unsigned short  last_vid;	/**< last VLAN id of the range, inclusive */
+	unsigned char  tagged;		/**< tagged or untagged membership */
+};
+
 struct oes_port_speed_capability {
 	unsigned char enable_1GB_CX_SGMII;
 	unsigned char enable_1GB_KX;
@@ -235,12 +299,64 @@ struct oes_port_speed_capability {
 	unsigned char enable_40GB_KR4;
 };
 
+struct oes_port_cntr_bulk {
+	unsigned int  grp_mask;						/**< bit field - enum oes_port_cntr_grp */
+	unsigned int  consumer_id;					/**< counter consumer, 0 for the default consumer */
+	unsigned short  port_cnt;					/**< number of ports */
+	unsigned long * log_port_list;					/**< logical ports array */
+	struct oes_port_cntr_ieee_802_dot_3 * cntr_ieee_802_dot_3_list;	/**< port_cnt elements, NULL if not in grp_mask */
+	struct oes_port_cntr_rfc_2863 * cntr_rfc_2863_list;		/**< port_cnt elements, NULL if not in grp_mask */
+	struct oes_port_cntr_rfc_2819 * cntr_rfc_2819_list;		/**< port_cnt elements, NULL if not in grp_mask */
+	struct oes_port_cntr_rfc_3635 * cntr_rfc_3635_list;		/**< port_cnt elements, NULL if not in grp_mask */
+	unsigned long long  timestamp_usec;				/**< time the snapshot was started */
+	unsigned long long  collect_usec;				/**< time it took to collect the snapshot */
+};
+
+struct oes_port_cntr_history_params {
+	unsigned int  grp_mask;		/**< bit field - enum oes_port_cntr_grp */
+	unsigned int  depth;		/**< number of snapshots kept per port, power of 2 */
+	unsigned int  interval_msec;	/**< time between snapshots */
+	unsigned int  ewma_weight_ppm;	/**< EWMA weight of the newest rate, parts per million */
+};
+
+struct oes_port_cntr_rate {
+	unsigned long long * delta_list;	/**< delta of each counter field over the window */
+	unsigned long long * rate_list;		/**< per second rate of each counter field over the window */
+	unsigned long long * ewma_list;		/**< EWMA of the per second rate of each counter field */
+	unsigned int  field_cnt;		/**< In: arrays size Out: number of counter fields of the group */
+	unsigned long long  timestamp_usec;	/**< time of the newest snapshot */
+	unsigned long long  interval_usec;	/**< time covered by the window */
+};
+
+struct oes_policer_params {
+	enum oes_policer_mode  mode;			/**< srTCM or trTCM */
+	enum oes_policer_meter_type  meter_type;	/**< bytes or packets */
+	unsigned long long  cir;			/**< committed information rate */
+	unsigned int  cbs;				/**< committed burst size */
+	unsigned long long  pir;			/**< peak information rate, trTCM only */
+	unsigned int  ebs;				/**< excess burst size (srTCM) or peak burst size (trTCM) */
+	unsigned char  color_aware;			/**< take the packet color into account */
+	enum oes_policer_action  yellow_action;	/**< action on yellow packets */
+	enum oes_policer_action  red_action;		/**< action on red packets */
+};
+
 struct oes_port_flow_control_param {
      enum oes_flow_control_mode  fc_mode;     /**< low control mode  global pause or per prio pause(pfc) */
      unsigned char prio;                    /**< prio , valid only in pfc mode */
      enum oes_port_flow_ctrl_enable fc_enable; /**<enable rx, tx or both */
 };
 
+struct oes_port_cfg {
+	unsigned long  log_port;				/**< Logical port */
+	unsigned int  field_mask;				/**< bit field - enum oes_port_cfg_field */
+	unsigned int  mtu;					/**< MTU payload size */
+	enum oes_port_admin_state  admin_state;		/**< admin state */
+	struct oes_port_speed_capability  speed_cap;		/**< speed capability */
+	struct oes_port_fc_param * fc_param;			/**< flow control parameter */
+	struct oes_port_flow_control_param  fc_enable;	/**< flow control mode */
+	unsigned short  pvid;					/**< Port VLAN ID */
+};
+
 struct oes_cos_tc_ets_config_params {
 	unsigned char   tc; /**<! Traffic class ID (0-7) to be configured */
 	unsigned char   bw_allocation;	/**<! Bandwidth percentage guaranteed to traffic_class within its TCG. */
@@ -291,6 +407,12 @@ struct oes_l3_interface_attributes{
 	unsigned short	mtu;
 };
 
+struct oes_router_my_mac_entry {
+	unsigned int  vrid;		/**< Virtual router ID */
+	unsigned int  rif;		/**< Router interface ID */
+	struct ether_addr  mac_addr;	/**< router MAC address */
+};
+
 struct oes_l3_interface_admin_state {
 	unsigned char  enable_ipv4;
     unsigned char  enable_ipv6;
@@ -305,6 +427,51 @@ struct oes_ip_addr {
 	} addr;
 };
 
+struct oes_sflow_agent_params {
+	struct oes_ip_addr  agent_ip;		/**< agent address reported in the datagrams */
+	unsigned int  sub_agent_id;		/**< sub agent ID */
+	enum oes_sflow_collector_type  collector_type;	/**< UDP or file */
+	struct oes_ip_addr  collector_ip;	/**< collector address, UDP only */
+	unsigned short  collector_port;	/**< collector UDP port, UDP only */
+	char  file_path[256];			/**< output file, FILE only */
+	unsigned short  max_datagram_size;	/**< datagram size limit in bytes */
+	unsigned int  queue_depth;		/**< samples queued per port before dropping */
+	unsigned int  flush_interval_msec;	/**< maximal time a sample waits for its datagram */
+	unsigned int  cntr_interval_sec;	/**< port counter samples interval, 0 to disable */
+};
+
+struct oes_sflow_agent_stats {
+	unsigned long long  sample_cnt;		/**< samples received from the trap path */
+	unsigned long long  sample_drop_cnt;	/**< samples dropped on a full port queue */
+	unsigned long long  datagram_cnt;	/**< datagrams sent */
+	unsigned long long  datagram_error_cnt;	/**< datagrams which could not be sent */
+};
+
+struct oes_router_flow {
+	unsigned char  src_ip[16];		/**< source address, IPv4 in the first 4 bytes, network order, unused bytes 0 */
+	unsigned char  dst_ip[16];		/**< destination address, same layout as src_ip */
+	unsigned int  flow_label;		/**< IPv6 flow label */
+	unsigned short  src_port;		/**< TCP/UDP source port */
+	unsigned short  dst_port;		/**< TCP/UDP destination port */
+	unsigned char  version;			/**< enum oes_ip_version */
+	unsigned char  ip_proto;		/**< IP protocol */
+	unsigned char  tc;			/**< traffic class */
+	unsigned char  reserved;		/**< always 0 */
+};
+
+struct oes_router_ecmp_balance {
+	unsigned int  min_flow_cnt;		/**< flows on the least loaded member */
+	unsigned int  max_flow_cnt;		/**< flows on the most loaded member */
+	unsigned int  imbalance_ppm;		/**< (max_flow_cnt / mean - 1) in parts per million, 0 if there are no flows */
+};
+
+struct oes_ip_key {
+	unsigned char  addr[16];	/**< address, IPv4 in the first 4 bytes, network order, unused bytes 0 */
+	unsigned char  version;		/**< enum oes_ip_version */
+	unsigned char  prefix_len;	/**< prefix length, 32/128 for a host address, 0 for the default route */
+	unsigned char  reserved[2];	/**< always 0 */
+};
+
 struct oes_neigh_data  {
     unsigned int rif;
     struct ether_addr * mac_addr; 
@@ -324,6 +491,41 @@ struct oes_uc_route_data {
 	unsigned char activity;
 };
 
+struct oes_uc_route_dump_cursor {
+	struct oes_ip_key  last_key;	/**< opaque, position after the last returned route */
+	unsigned char  started;		/**< 0 to start the dump from the first route */
+	unsigned char  done;		/**< set when the last route was returned */
+};
+
+struct oes_uc_route_dump_entry {
+	unsigned char  addr[16];	/**< network address, IPv4 in the first 4 bytes, network order */
+	unsigned char  version;		/**< enum oes_ip_version */
+	unsigned char  prefix_len;	/**< prefix length */
+	unsigned char  action;		/**< enum oes_router_action */
+	unsigned char  activity;	/**< activity */
+	unsigned int   next_hop_index;	/**< first next hop in the dump next hop array */
+	unsigned int   next_hop_cnt;	/**< number of next hops */
+};
+
+struct oes_uc_route_lookup_result {
+	struct oes_ip_key  prefix;		/**< matched route, valid if found is 1 */
+	struct oes_ip_addr  next_hop;		/**< first next hop of the matched route, not the ECMP member of a flow */
+	enum oes_router_action  action;	/**< action of the matched route */
+	unsigned short  next_hop_cnt;		/**< number of next hops of the matched route */
+	unsigned char  found;			/**< 0 if no route matches the address */
+};
+
+struct oes_uc_route_digest {
+	unsigned long long  digest;	/**< sum modulo 2^64 of the route hashes */
+	unsigned int  uc_route_cnt;	/**< number of routes in the range */
+};
+
+struct oes_router_fib_compress_stats {
+	unsigned int  uc_route_cnt;		/**< routes configured by the user */
+	unsigned int  programmed_route_cnt;	/**< routes written to the device */
+	unsigned long long  update_cnt;	/**< device writes caused by route changes */
+};
+
 struct oes_router_cntr {
 	unsigned long long  router_ingress_unicast_packets;
 	unsigned long long  router_ingress_multicast_packets;
@@ -335,6 +537,27 @@ struct oes_router_cntr {
 	unsigned long long  router_egress_multicast_bytes;
 };
 
+struct oes_router_cntr_bulk_entry {
+	unsigned int  vrid;			/**< Virtual router ID */
+	unsigned int  rif;			/**< Router interface ID */
+	struct oes_router_cntr  cntr;		/**< absolute value or delta, according to cntr_mode */
+	struct oes_router_cntr  rate;		/**< per second rate, valid in RATE mode only */
+	unsigned long long  interval_usec;	/**< time elapsed since the previous snapshot */
+	unsigned char  delta_valid;		/**< 0 on the first snapshot after counter enable */
+};
+
+struct oes_router_mem_usage {
+	unsigned long long  base_bytes;		/**< fixed per virtual router state */
+	unsigned long long  uc_route_ipv4_bytes;	/**< IPv4 unicast FIB */
+	unsigned long long  uc_route_ipv6_bytes;	/**< IPv6 unicast FIB */
+	unsigned long long  uc_route_programmed_bytes;	/**< programmed FIB, FIB compression only */
+	unsigned long long  uc_route_digest_bytes;	/**< per subtree route digests */
+	unsigned long long  ecmp_bucket_bytes;	/**< resilient ECMP bucket tables */
+	unsigned long long  neigh_bytes;		/**< neighbour table */
+	unsigned long long  rif_bytes;		/**< router interface map */
+	unsigned long long  mc_route_bytes;		/**< multicast routing table */
+	unsigned long long  total_bytes;		/**< sum of all of the above */
+};
 
 struct oes_mc_route_key {
 	struct oes_ip_addr *  mc_gruop_ip;
@@ -365,9 +588,27 @@ struct oes_event_info{
 
 
 
+struct oes_event_port_damping_params {
+	unsigned char  enable;		/**<! enable flap damping on the port */
+	unsigned int   flap_penalty;	/**<! penalty added on every up/down transition */
+	unsigned int   suppress_threshold;	/**<! penalty above which transitions are suppressed */
+	unsigned int   reuse_threshold;	/**<! penalty below which transitions are reported again */
+	unsigned int   half_life_sec;	/**<! time for the penalty to decay by half */
+	unsigned int   max_suppress_sec;	/**<! maximal time transitions are suppressed */
+};
+
+struct oes_event_port_damping {
+	unsigned int       log_port;/**<! logical port */
+	unsigned char      suppressed;/**<! 1 when suppression starts, 0 when it ends */
+	enum oes_port_oper_state port_state;/**<! operational state when the event is sent */
+	unsigned int       penalty;/**<! current penalty */
+	unsigned int       suppressed_cnt;/**<! transitions suppressed since suppression started */
+};
+
 union oes_event_data{
 	struct oes_event_port port_event;/**<! port up/down event data */
     struct oes_event_port port_event;/**<! FDB  event data */
+	struct oes_event_port_damping port_damping_event;/**<! port flap damping event data */
 };
 
 